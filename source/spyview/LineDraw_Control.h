@@ -27,6 +27,10 @@ private:
   static void cb_Reload(Fl_Button*, void*);
 public:
   Fl_File_Input *file;
+private:
+  void cb_file_i(Fl_File_Input*, void*);
+  static void cb_file(Fl_File_Input*, void*);
+public:
   Fl_Light_Button *autodelete;
   Fl_Light_Button *autognu;
 private:
@@ -19,4 +19,7 @@ string str_printf(const char *str, ...)  __attribute__ ((format (printf,1,2)));
 // Strip newlines and \r
 void strip_newlines(string &string);
 
+// Monotonic wall clock in seconds, for timing loads and filters
+double wall_time();
+
 #endif
@@ -88,6 +88,8 @@ extern Fl_Round_Button *keep_zoom;
 extern Fl_Round_Button *keep_size;
 extern Fl_Round_Button *reset_zoom;
 extern Fl_Check_Button *norm_on_load;
+extern Fl_Check_Button *auto_reload;
+extern Fl_Value_Input *threads_input;
 extern Fl_Round_Button *a_quant;
 extern Fl_Round_Button *man_quant;
 extern Fl_Value_Input *a_quant_percent;
@@ -103,6 +105,7 @@ extern Fl_Check_Button *gp_parse_txt;
 extern Fl_Check_Button *gp_delft_raw;
 extern Fl_Round_Button *dat_type_meta;
 extern Fl_Check_Button *gp_delft_set;
+extern Fl_Check_Button *mtx_float32;
 extern Fl_Button *requantize;
 extern Fl_Value_Input *gp_col;
 extern Fl_Double_Window *unitswin;
@@ -190,4 +193,5 @@ extern std::vector<Fl_Check_Button *> proc_bool_parameters;
 extern std::vector<Fl_Choice *> proc_choice_parameters;
 extern std::vector<Fl_Button *> proc_button_parameters;
 void reload_data();
+void preview_data();
 #endif